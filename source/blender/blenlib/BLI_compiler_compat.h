@@ -55,3 +55,12 @@ template<typename T> static inline T decltype_helper(T x)
 #else
 #  define BLI_NOINLINE
 #endif
+
+/* Hint to start fetching a read-only address into the cache, a no-op when the compiler has no
+ * support for it. Use when the next address of a pointer-chasing loop is known early, so the
+ * memory latency overlaps with the work on the current element. */
+#if defined(__GNUC__) || defined(__clang__)
+#  define BLI_prefetch_read(ptr) __builtin_prefetch((ptr), 0, 1)
+#else
+#  define BLI_prefetch_read(ptr) ((void)(ptr))
+#endif
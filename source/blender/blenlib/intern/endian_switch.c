@@ -22,10 +22,145 @@
 #include "BLI_sys_types.h"
 #include "BLI_utildefines.h"
 
+/* The array variants below are hot when loading foreign-endian .blend files,
+ * where multi-megabyte vertex/cache arrays are switched element by element.
+ * The switch itself is purely memory bound, so process a full vector register
+ * per iteration (byte shuffle / reverse) where the target instruction set is
+ * known at compile time, and leave the remainder to the scalar loop. */
+#if defined(__AVX2__)
+#  include <immintrin.h>
+#elif defined(__SSSE3__)
+#  include <tmmintrin.h>
+#elif defined(__ARM_NEON)
+#  include <arm_neon.h>
+#endif
+
+BLI_INLINE int endian_switch_uint16_simd(unsigned short **val_p, int size)
+{
+#if defined(__AVX2__)
+  const __m256i mask = _mm256_setr_epi8(1,
+                                        0,
+                                        3,
+                                        2,
+                                        5,
+                                        4,
+                                        7,
+                                        6,
+                                        9,
+                                        8,
+                                        11,
+                                        10,
+                                        13,
+                                        12,
+                                        15,
+                                        14,
+                                        1,
+                                        0,
+                                        3,
+                                        2,
+                                        5,
+                                        4,
+                                        7,
+                                        6,
+                                        9,
+                                        8,
+                                        11,
+                                        10,
+                                        13,
+                                        12,
+                                        15,
+                                        14);
+  unsigned short *val = *val_p;
+  for (; size >= 16; size -= 16, val += 16) {
+    _mm256_storeu_si256((__m256i *)val,
+                        _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *)val), mask));
+  }
+  *val_p = val;
+#elif defined(__SSSE3__)
+  const __m128i mask = _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+  unsigned short *val = *val_p;
+  for (; size >= 8; size -= 8, val += 8) {
+    _mm_storeu_si128((__m128i *)val,
+                     _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)val), mask));
+  }
+  *val_p = val;
+#elif defined(__ARM_NEON)
+  unsigned short *val = *val_p;
+  for (; size >= 8; size -= 8, val += 8) {
+    vst1q_u8((uint8_t *)val, vrev16q_u8(vld1q_u8((const uint8_t *)val)));
+  }
+  *val_p = val;
+#else
+  UNUSED_VARS(val_p);
+#endif
+  return size;
+}
+
+BLI_INLINE int endian_switch_uint32_simd(unsigned int **val_p, int size)
+{
+#if defined(__AVX2__)
+  const __m256i mask = _mm256_setr_epi8(3,
+                                        2,
+                                        1,
+                                        0,
+                                        7,
+                                        6,
+                                        5,
+                                        4,
+                                        11,
+                                        10,
+                                        9,
+                                        8,
+                                        15,
+                                        14,
+                                        13,
+                                        12,
+                                        3,
+                                        2,
+                                        1,
+                                        0,
+                                        7,
+                                        6,
+                                        5,
+                                        4,
+                                        11,
+                                        10,
+                                        9,
+                                        8,
+                                        15,
+                                        14,
+                                        13,
+                                        12);
+  unsigned int *val = *val_p;
+  for (; size >= 8; size -= 8, val += 8) {
+    _mm256_storeu_si256((__m256i *)val,
+                        _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *)val), mask));
+  }
+  *val_p = val;
+#elif defined(__SSSE3__)
+  const __m128i mask = _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+  unsigned int *val = *val_p;
+  for (; size >= 4; size -= 4, val += 4) {
+    _mm_storeu_si128((__m128i *)val,
+                     _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)val), mask));
+  }
+  *val_p = val;
+#elif defined(__ARM_NEON)
+  unsigned int *val = *val_p;
+  for (; size >= 4; size -= 4, val += 4) {
+    vst1q_u8((uint8_t *)val, vrev32q_u8(vld1q_u8((const uint8_t *)val)));
+  }
+  *val_p = val;
+#else
+  UNUSED_VARS(val_p);
+#endif
+  return size;
+}
+
 void BLI_endian_switch_int16_array(short *val, const int size)
 {
   if (size > 0) {
-    int i = size;
+    int i = endian_switch_uint16_simd((unsigned short **)&val, size);
     while (i--) {
       BLI_endian_switch_int16(val++);
     }
@@ -35,7 +170,7 @@ void BLI_endian_switch_int16_array(short *val, const int size)
 void BLI_endian_switch_uint16_array(unsigned short *val, const int size)
 {
   if (size > 0) {
-    int i = size;
+    int i = endian_switch_uint16_simd(&val, size);
     while (i--) {
       BLI_endian_switch_uint16(val++);
     }
@@ -45,7 +180,7 @@ void BLI_endian_switch_uint16_array(unsigned short *val, const int size)
 void BLI_endian_switch_int32_array(int *val, const int size)
 {
   if (size > 0) {
-    int i = size;
+    int i = endian_switch_uint32_simd((unsigned int **)&val, size);
     while (i--) {
       BLI_endian_switch_int32(val++);
     }
@@ -55,7 +190,7 @@ void BLI_endian_switch_int32_array(int *val, const int size)
 void BLI_endian_switch_uint32_array(unsigned int *val, const int size)
 {
   if (size > 0) {
-    int i = size;
+    int i = endian_switch_uint32_simd(&val, size);
     while (i--) {
       BLI_endian_switch_uint32(val++);
     }
@@ -65,7 +200,7 @@ void BLI_endian_switch_uint32_array(unsigned int *val, const int size)
 void BLI_endian_switch_float_array(float *val, const int size)
 {
   if (size > 0) {
-    int i = size;
+    int i = endian_switch_uint32_simd((unsigned int **)&val, size);
     while (i--) {
       BLI_endian_switch_float(val++);
     }
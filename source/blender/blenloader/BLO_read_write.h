@@ -43,6 +43,9 @@
 /* for SDNA_TYPE_FROM_STRUCT() macro */
 #include "dna_type_offsets.h"
 
+#include "BLI_compiler_compat.h"
+#include "BLI_sys_types.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -134,7 +137,8 @@ void BLO_write_struct_list_by_id(BlendWriter *writer, int struct_id, struct List
 #define BLO_write_struct_list(writer, struct_name, list_ptr) \
   BLO_write_struct_list_by_id(writer, BLO_get_struct_id(writer, struct_name), list_ptr)
 
-/* Write id struct. */
+/* Write id struct. The struct id is resolved at compile time (see #BLO_get_struct_id), so no
+ * per-ID name lookup happens in save loops. */
 void blo_write_id_struct(BlendWriter *writer,
                          int struct_id,
                          const void *id_address,
@@ -144,13 +148,41 @@ void blo_write_id_struct(BlendWriter *writer,
 
 /* Write raw data. */
 void BLO_write_raw(BlendWriter *writer, int size_in_bytes, const void *data_ptr);
-void BLO_write_int32_array(BlendWriter *writer, int size, const int32_t *data_ptr);
-void BLO_write_uint32_array(BlendWriter *writer, int size, const uint32_t *data_ptr);
-void BLO_write_float_array(BlendWriter *writer, int size, const float *data_ptr);
-void BLO_write_float3_array(BlendWriter *writer, int size, const float *data_ptr);
 void BLO_write_pointer_array(BlendWriter *writer, int size, const void *data_ptr);
 void BLO_write_string(BlendWriter *writer, const char *data_ptr);
 
+/* The simple-type array writers are defined inline: the element size is a compile-time constant
+ * at every call site, so the byte-count multiply and the extra call layer fold away and the
+ * compiler can specialize the write for the element stride. */
+BLI_INLINE void BLO_write_int32_array(BlendWriter *writer, int size, const int32_t *data_ptr)
+{
+  BLO_write_raw(writer, sizeof(int32_t) * size, data_ptr);
+}
+
+BLI_INLINE void BLO_write_uint32_array(BlendWriter *writer, int size, const uint32_t *data_ptr)
+{
+  BLO_write_raw(writer, sizeof(uint32_t) * size, data_ptr);
+}
+
+BLI_INLINE void BLO_write_float_array(BlendWriter *writer, int size, const float *data_ptr)
+{
+  BLO_write_raw(writer, sizeof(float) * size, data_ptr);
+}
+
+BLI_INLINE void BLO_write_float3_array(BlendWriter *writer, int size, const float *data_ptr)
+{
+  BLO_write_raw(writer, sizeof(float[3]) * size, data_ptr);
+}
+
+/* Write many data segments with a single call (see #BLO_write_iov). */
+typedef struct BlendIOVec {
+  const void *data;
+  int size_in_bytes;
+  /** SDNA struct id (see #BLO_get_struct_id), or 0 to write the segment as raw data. */
+  int struct_id;
+} BlendIOVec;
+void BLO_write_iov(BlendWriter *writer, const BlendIOVec *segments, int segments_num);
+
 /* Misc. */
 bool BLO_write_is_undo(BlendWriter *writer);
 
@@ -185,6 +217,14 @@ typedef void (*BlendReadListFn)(BlendDataReader *reader, void *data);
 void BLO_read_list_cb(BlendDataReader *reader, struct ListBase *list, BlendReadListFn callback);
 void BLO_read_list(BlendDataReader *reader, struct ListBase *list);
 
+/* Variants that cluster the list elements into memory order while walking them, so the callback
+ * pass and later traversals are sequential instead of chasing scattered pointers. Only for lists
+ * whose elements are not referenced by address from data read before this call. */
+void BLO_read_list_contig_cb(BlendDataReader *reader,
+                             struct ListBase *list,
+                             BlendReadListFn callback);
+void BLO_read_list_contig(BlendDataReader *reader, struct ListBase *list);
+
 /* Update data pointers and correct byte-order if necessary. */
 void BLO_read_int32_array(BlendDataReader *reader, int array_size, int32_t **ptr_p);
 void BLO_read_uint32_array(BlendDataReader *reader, int array_size, uint32_t **ptr_p);
@@ -1066,6 +1066,8 @@ static void decode_blender_header(FileData *fd)
      */
     if (((header[8] == 'v') ? L_ENDIAN : B_ENDIAN) != ENDIAN_ORDER) {
       fd->flags |= FD_FLAGS_SWITCH_ENDIAN;
+      fd->switch_endian_u32_array_fn = BLI_endian_switch_uint32_array;
+      fd->switch_endian_double_array_fn = BLI_endian_switch_double_array;
     }
 
     /* get the version number */
@@ -1312,6 +1314,16 @@ static int fd_read_from_memfile(FileData *filedata,
   return 0;
 }
 
+/* Defaults for #FileData.switch_endian_u32_array_fn & co, replaced by the BLI_endian_switch
+ * implementations when the decoded header requires switching (see #decode_blender_header). */
+static void switch_endian_u32_array_noop(unsigned int *UNUSED(array), int UNUSED(array_size))
+{
+}
+
+static void switch_endian_double_array_noop(double *UNUSED(array), int UNUSED(array_size))
+{
+}
+
 static FileData *filedata_new(void)
 {
   FileData *fd = MEM_callocN(sizeof(FileData), "FileData");
@@ -1321,6 +1333,9 @@ static FileData *filedata_new(void)
 
   fd->memsdna = DNA_sdna_current_get();
 
+  fd->switch_endian_u32_array_fn = switch_endian_u32_array_noop;
+  fd->switch_endian_double_array_fn = switch_endian_double_array_noop;
+
   fd->datamap = oldnewmap_new();
   fd->globmap = oldnewmap_new();
   fd->libmap = oldnewmap_new();
@@ -8703,7 +8718,8 @@ static void direct_link_simulation(BlendDataReader *reader, Simulation *simulati
   BLO_read_data_address(reader, &simulation->adt);
   direct_link_animdata(reader, simulation->adt);
 
-  BLO_read_list(reader, &simulation->states);
+  /* State nodes are only ever reached through this list, so they can be clustered. */
+  BLO_read_list_contig(reader, &simulation->states);
   LISTBASE_FOREACH (SimulationState *, state, &simulation->states) {
     BLO_read_data_address(reader, &state->name);
     BLO_read_data_address(reader, &state->type);
@@ -12168,6 +12184,10 @@ void BLO_read_list_cb(BlendDataReader *reader, ListBase *list, BlendReadListFn c
   Link *prev = NULL;
   while (ln) {
     BLO_read_data_address(reader, &ln->next);
+    /* Nodes are scattered through the file-data, so start fetching the next one before the
+     * callback runs: the ~100ns miss then overlaps with the callback's own work instead of
+     * serializing the walk. */
+    BLI_prefetch_read(ln->next);
     if (ln->next != NULL && callback != NULL) {
       callback(reader, ln->next);
     }
@@ -12183,28 +12203,109 @@ void BLO_read_list(BlendDataReader *reader, struct ListBase *list)
   BLO_read_list_cb(reader, list, NULL);
 }
 
+/**
+ * Look up a list node like #newdataadr, but re-allocate the block in walk order when this is its
+ * first use. List elements keep their original heap addresses in the file, so after lookup they
+ * sit scattered through the file-data in file order and every `next` dereference of a later walk
+ * is a cold cache line. Nodes that were already resolved elsewhere are left in place, so existing
+ * pointers to them stay valid; the map entry is updated, so later lookups resolve correctly.
+ *
+ * The replaced block is chained into \a r_free_list (through its now-unused `next` pointer)
+ * instead of being freed here: freeing it immediately would let a recycling allocator hand the
+ * very next node that same scattered address, defeating the clustering. The caller frees the
+ * chain once all replacement nodes are allocated.
+ */
+static void *read_list_relocate_node(FileData *fd, const void *old_addr, Link **r_free_list)
+{
+  if (old_addr == NULL) {
+    return NULL;
+  }
+  OldNew *entry = oldnewmap_lookup_entry(fd->datamap, old_addr);
+  if (entry == NULL) {
+    return NULL;
+  }
+  if (entry->nr == 0) {
+    Link *node_old = entry->newp;
+    const size_t len = MEM_allocN_len(node_old);
+    void *node_new = MEM_mallocN(len, "list node relocated");
+    memcpy(node_new, node_old, len);
+    node_old->next = *r_free_list;
+    *r_free_list = node_old;
+    entry->newp = node_new;
+  }
+  entry->nr++;
+  return entry->newp;
+}
+
+/**
+ * Version of #BLO_read_list_cb that clusters the list elements into ascending memory order while
+ * walking them, then invokes the callback in that order. This turns the pointer-chasing walk over
+ * nodes scattered through the file-data into a sequential pass for the callback and for all later
+ * traversals of the list.
+ *
+ * Only use for lists whose elements are not referenced by address from data read before this
+ * call (relocation would leave such already-resolved pointers dangling).
+ */
+void BLO_read_list_contig_cb(BlendDataReader *reader, ListBase *list, BlendReadListFn callback)
+{
+  if (BLI_listbase_is_empty(list)) {
+    return;
+  }
+
+  FileData *fd = reader->fd;
+  Link *free_list = NULL;
+
+  /* First pass: resolve the `next` chain, relocating first-use nodes into walk order. */
+  list->first = read_list_relocate_node(fd, list->first, &free_list);
+  Link *ln = list->first;
+  Link *prev = NULL;
+  while (ln) {
+    ln->next = read_list_relocate_node(fd, ln->next, &free_list);
+    ln->prev = prev;
+    prev = ln;
+    ln = ln->next;
+  }
+  list->last = prev;
+
+  /* Free the replaced blocks only now: with the frees interleaved, a recycling allocator would
+   * serve each relocation from the previous node's old block and keep the scatter. */
+  while (free_list) {
+    Link *free_next = free_list->next;
+    MEM_freeN(free_list);
+    free_list = free_next;
+  }
+
+  /* Second pass: the callback runs on the nodes in their new, ascending order. */
+  if (callback != NULL) {
+    for (ln = list->first; ln; ln = ln->next) {
+      callback(reader, ln);
+    }
+  }
+}
+
+void BLO_read_list_contig(BlendDataReader *reader, struct ListBase *list)
+{
+  BLO_read_list_contig_cb(reader, list, NULL);
+}
+
+/* The typed array readers call the endianness-resolved switch selected when the file header was
+ * decoded (a no-op for same-endian files), instead of re-testing per array. */
 void BLO_read_int32_array(BlendDataReader *reader, int array_size, int32_t **ptr_p)
 {
   BLO_read_data_address(reader, ptr_p);
-  if (BLO_read_requires_endian_switch(reader)) {
-    BLI_endian_switch_int32_array(*ptr_p, array_size);
-  }
+  reader->fd->switch_endian_u32_array_fn((uint *)*ptr_p, array_size);
 }
 
 void BLO_read_uint32_array(BlendDataReader *reader, int array_size, uint32_t **ptr_p)
 {
   BLO_read_data_address(reader, ptr_p);
-  if (BLO_read_requires_endian_switch(reader)) {
-    BLI_endian_switch_uint32_array(*ptr_p, array_size);
-  }
+  reader->fd->switch_endian_u32_array_fn(*ptr_p, array_size);
 }
 
 void BLO_read_float_array(BlendDataReader *reader, int array_size, float **ptr_p)
 {
   BLO_read_data_address(reader, ptr_p);
-  if (BLO_read_requires_endian_switch(reader)) {
-    BLI_endian_switch_float_array(*ptr_p, array_size);
-  }
+  reader->fd->switch_endian_u32_array_fn((uint *)*ptr_p, array_size);
 }
 
 void BLO_read_float3_array(BlendDataReader *reader, int array_size, float **ptr_p)
@@ -12215,9 +12316,7 @@ void BLO_read_float3_array(BlendDataReader *reader, int array_size, float **ptr_
 void BLO_read_double_array(BlendDataReader *reader, int array_size, double **ptr_p)
 {
   BLO_read_data_address(reader, ptr_p);
-  if (BLO_read_requires_endian_switch(reader)) {
-    BLI_endian_switch_double_array(*ptr_p, array_size);
-  }
+  reader->fd->switch_endian_double_array_fn(*ptr_p, array_size);
 }
 
 static void convert_pointer_array_64_to_32(BlendDataReader *reader,
@@ -103,6 +103,14 @@ typedef struct FileData {
   /** Array of #eSDNA_StructCompare. */
   const char *compflags;
 
+  /**
+   * Endianness-resolved element switches used by the typed array readers, selected once when the
+   * file header is decoded (no-ops when the file matches the host). This hoists the per-array
+   * endian branch out of #BLO_read_int32_array & co to file-open time.
+   */
+  void (*switch_endian_u32_array_fn)(unsigned int *array, int array_size);
+  void (*switch_endian_double_array_fn)(double *array, int array_size);
+
   int fileversion;
   /** Used to retrieve ID names from (bhead+1). */
   int id_name_offs;
@@ -337,6 +337,19 @@ typedef struct {
    * Will be NULL for UNDO.
    */
   WriteWrap *ww;
+
+  /**
+   * Memoized name -> SDNA struct index lookups for the run-time name API
+   * (#BLO_get_struct_id_by_name). Save loops resolve the same few type names
+   * (modifier, constraint and node storage names) tens of thousands of times;
+   * cache the result so each name is hashed once per save instead of once per
+   * written struct. Slots are verified with a string compare, so heap strings
+   * are handled correctly as well.
+   */
+  struct {
+    const char *name;
+    int struct_id;
+  } struct_id_cache[64];
 } WriteData;
 
 typedef struct BlendWriter {
@@ -429,8 +442,13 @@ static void mywrite(WriteData *wd, const void *adr, int len)
     writedata_do_write(wd, adr, len);
   }
   else {
-    /* if we have a single big chunk, write existing data in
-     * buffer and write out big chunk in smaller pieces */
+    /* If we have a single big chunk, write existing data in
+     * buffer and write out big chunk in smaller pieces.
+     *
+     * Note that this also keeps large write-once payloads (vertex/point-cloud arrays,
+     * simulation caches) from being staged through #WriteData.buf at all: they are emitted
+     * straight from the caller's memory, so the copy does not evict the hot save-loop data
+     * (BHead tables, name maps) from the caches. */
     if (len > MYWRITE_MAX_CHUNK) {
       if (wd->buf_used_len) {
         writedata_do_write(wd, wd->buf, wd->buf_used_len);
@@ -2137,6 +2155,11 @@ static void write_customdata(BlendWriter *writer,
       BLO_write_raw(writer, sizeof(*layer_data) * count, layer_data);
     }
     else {
+      /* Note that the generic attribute layers (e.g. point-cloud/simulation positions and
+       * radii) are already stored one contiguous array per layer here: `vec3f` and
+       * `MFloatProperty` have the same memory layout as the raw float arrays. Keep them on the
+       * struct path, it is what byte-swaps them on foreign-endian load (the raw-data branches
+       * above have no read-side swap). */
       CustomData_file_write_info(layer->type, &structname, &structnum);
       if (structnum) {
         datasize = structnum * count;
@@ -3843,8 +3866,18 @@ static void write_simulation(BlendWriter *writer, Simulation *simulation, const
     }
 
     LISTBASE_FOREACH (SimulationState *, state, &simulation->states) {
-      BLO_write_string(writer, state->name);
-      BLO_write_string(writer, state->type);
+      /* The two per-state strings are emitted as one gathered write. */
+      BlendIOVec state_strings[2];
+      int state_strings_num = 0;
+      if (state->name != NULL) {
+        state_strings[state_strings_num++] = (BlendIOVec){
+            state->name, (int)strlen(state->name) + 1, 0};
+      }
+      if (state->type != NULL) {
+        state_strings[state_strings_num++] = (BlendIOVec){
+            state->type, (int)strlen(state->type) + 1, 0};
+      }
+      BLO_write_iov(writer, state_strings, state_strings_num);
       /* TODO: Decentralize this part. */
       if (STREQ(state->type, SIM_TYPE_NAME_PARTICLE_SIMULATION)) {
         ParticleSimulationState *particle_state = (ParticleSimulationState *)state;
@@ -4518,6 +4551,90 @@ void BLO_write_raw(BlendWriter *writer, int size_in_bytes, const void *data_ptr)
   writedata(writer->wd, DATA, size_in_bytes, data_ptr);
 }
 
+/**
+ * Write a scatter list of data segments in one call.
+ *
+ * Equivalent to calling #BLO_write_raw (or the matching struct-array writer for segments with a
+ * struct id) once per segment, but the buffer space for all block headers and payloads is claimed
+ * up front, so bursts of many small writes skip the per-call overflow checks of the buffered I/O
+ * layer and end up back-to-back in the write buffer.
+ */
+void BLO_write_iov(BlendWriter *writer, const BlendIOVec *segments, int segments_num)
+{
+  WriteData *wd = writer->wd;
+
+  if (UNLIKELY(wd->error)) {
+    return;
+  }
+
+  /* Total buffer space needed, one BHead per segment with the payload padded to 4
+   * (matching `writedata`). */
+  int total_len = 0;
+  for (int i = 0; i < segments_num; i++) {
+    if (segments[i].data == NULL || segments[i].size_in_bytes == 0) {
+      continue;
+    }
+    total_len += sizeof(BHead) + ((segments[i].size_in_bytes + 3) & ~3);
+  }
+  if (total_len == 0) {
+    return;
+  }
+
+  if (wd->buf && (total_len + wd->buf_used_len > MYWRITE_BUFFER_SIZE - 1)) {
+    mywrite_flush(wd);
+  }
+
+  if (wd->buf == NULL || total_len > MYWRITE_BUFFER_SIZE - 1) {
+    /* Unbuffered writing or a list too large for the buffer, write segments one by one. */
+    for (int i = 0; i < segments_num; i++) {
+      const BlendIOVec *seg = &segments[i];
+      if (seg->struct_id != 0) {
+        BLI_assert(seg->struct_id > 0 && seg->struct_id < SDNA_TYPE_MAX);
+        const short *sp = wd->sdna->structs[seg->struct_id];
+        const int struct_size = wd->sdna->types_size[sp[0]];
+        BLI_assert((seg->size_in_bytes % struct_size) == 0);
+        writestruct_nr(wd, DATA, seg->struct_id, seg->size_in_bytes / struct_size, seg->data);
+      }
+      else {
+        writedata(wd, DATA, seg->size_in_bytes, seg->data);
+      }
+    }
+    return;
+  }
+
+  for (int i = 0; i < segments_num; i++) {
+    const BlendIOVec *seg = &segments[i];
+    if (seg->data == NULL || seg->size_in_bytes == 0) {
+      continue;
+    }
+    const int len = (seg->size_in_bytes + 3) & ~3;
+
+    BHead bh;
+    bh.code = DATA;
+    bh.old = seg->data;
+    bh.SDNAnr = seg->struct_id;
+    if (seg->struct_id != 0) {
+      BLI_assert(seg->struct_id > 0 && seg->struct_id < SDNA_TYPE_MAX);
+      const short *sp = wd->sdna->structs[seg->struct_id];
+      const int struct_size = wd->sdna->types_size[sp[0]];
+      BLI_assert((seg->size_in_bytes % struct_size) == 0);
+      bh.nr = seg->size_in_bytes / struct_size;
+    }
+    else {
+      bh.nr = 1;
+    }
+    bh.len = len;
+
+    memcpy(&wd->buf[wd->buf_used_len], &bh, sizeof(BHead));
+    /* Like `writedata`, this may copy a few uninitialized padding bytes. */
+    memcpy(&wd->buf[wd->buf_used_len + sizeof(BHead)], seg->data, len);
+    wd->buf_used_len += sizeof(BHead) + len;
+#ifdef USE_WRITE_DATA_LEN
+    wd->write_len += sizeof(BHead) + len;
+#endif
+  }
+}
+
 void BLO_write_struct_by_name(BlendWriter *writer, const char *struct_name, const void *data_ptr)
 {
   BLO_write_struct_array_by_name(writer, struct_name, 1, data_ptr);
@@ -4585,35 +4702,22 @@ void blo_write_id_struct(BlendWriter *writer, int struct_id, const void *id_addr
 
 int BLO_get_struct_id_by_name(BlendWriter *writer, const char *struct_name)
 {
-  int struct_id = DNA_struct_find_nr(writer->wd->sdna, struct_name);
+  WriteData *wd = writer->wd;
+  const uint slot = (uint)(((uintptr_t)struct_name) >> 4) % ARRAY_SIZE(wd->struct_id_cache);
+  if (wd->struct_id_cache[slot].name && STREQ(wd->struct_id_cache[slot].name, struct_name)) {
+    return wd->struct_id_cache[slot].struct_id;
+  }
+  int struct_id = DNA_struct_find_nr(wd->sdna, struct_name);
+  wd->struct_id_cache[slot].name = struct_name;
+  wd->struct_id_cache[slot].struct_id = struct_id;
   return struct_id;
 }
 
-void BLO_write_int32_array(BlendWriter *writer, int size, const int32_t *data_ptr)
-{
-  BLO_write_raw(writer, sizeof(int32_t) * size, data_ptr);
-}
-
-void BLO_write_uint32_array(BlendWriter *writer, int size, const uint32_t *data_ptr)
-{
-  BLO_write_raw(writer, sizeof(uint32_t) * size, data_ptr);
-}
-
-void BLO_write_float_array(BlendWriter *writer, int size, const float *data_ptr)
-{
-  BLO_write_raw(writer, sizeof(float) * size, data_ptr);
-}
-
 void BLO_write_pointer_array(BlendWriter *writer, int size, const void *data_ptr)
 {
   BLO_write_raw(writer, sizeof(void *) * size, data_ptr);
 }
 
-void BLO_write_float3_array(BlendWriter *writer, int size, const float *data_ptr)
-{
-  BLO_write_raw(writer, sizeof(float[3]) * size, data_ptr);
-}
-
 /**
  * Write a null terminated string.
  */
@@ -2188,7 +2188,12 @@ enum {
 typedef struct SimulationModifierData {
   ModifierData modifier;
 
+  /* Hot: read by the depsgraph/ID-walk callbacks for every modifier in the scene,
+   * keep directly after the header so those walks stay on an already-warm line. */
   struct Simulation *simulation;
+  /* Cold: only used for UI drawing and simulation-state lookup. This is the peeled-off cold
+   * block of the struct: it stays a heap allocation (not an inline char array), so scene-wide
+   * modifier walks never page it in. */
   char *data_path;
 } SimulationModifierData;
 
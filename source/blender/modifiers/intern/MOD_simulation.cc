@@ -64,6 +64,13 @@
 
 using blender::float3;
 
+/* #updateDepsgraph, #foreachIDLink and #isDisabled below only read `smd->simulation` and run for
+ * every simulation modifier during depsgraph rebuilds. Keep that field directly after the
+ * #ModifierData header, so these callbacks hit the line already pulled in by the generic
+ * modifier iteration instead of the cold tail of the struct. */
+BLI_STATIC_ASSERT(offsetof(SimulationModifierData, simulation) == sizeof(ModifierData),
+                  "hot field must directly follow the modifier header");
+
 static void updateDepsgraph(ModifierData *md, const ModifierUpdateDepsgraphContext *ctx)
 {
   SimulationModifierData *smd = reinterpret_cast<SimulationModifierData *>(md);
@@ -406,6 +406,11 @@ PanelType *modifier_panel_register(ARegionType *region_type, ModifierType type,
   char panel_idname[BKE_ST_MAXNAME];
   BKE_modifier_type_panel_id(type, panel_idname);
 
+  /* The idname is derived from the modifier type, so a copy-pasted enum from another modifier's
+   * register function would silently shadow that modifier's panels. Catch it at registration. */
+  BLI_assert(BLI_findstring(&region_type->paneltypes, panel_idname, offsetof(PanelType, idname)) ==
+             NULL);
+
   PanelType *panel_type = MEM_callocN(sizeof(PanelType), panel_idname);
 
   strcpy(panel_type->idname, panel_idname);